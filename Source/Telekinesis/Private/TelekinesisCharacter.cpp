@@ -16,9 +16,111 @@
 #include "Camera/PlayerCameraManager.h"
 #include "GameFramework/PlayerController.h"
 #include "Components/AudioComponent.h"
+#include "Physics/PhysicsInterfaceCore.h"
+
+#if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX
+#include "PhysXPublic.h"
+#endif
 
 DEFINE_LOG_CATEGORY_STATIC(LogFPChar, Warning, All);
 
+DECLARE_STATS_GROUP(TEXT("Telekinesis"), STATGROUP_Telekinesis, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Escalated Bodies"), STAT_TelekinesisEscalatedBodies, STATGROUP_Telekinesis);
+
+/** Escalation of one body, shared by every character that holds it or threw it */
+struct FTelekinesisBodyEscalation
+{
+	/** Number of characters that still need this body escalated */
+	int32 RefCount;
+
+	/** Solver iteration counts the body had before escalation */
+	uint32 PreviousPositionIterations;
+	uint32 PreviousVelocityIterations;
+};
+
+/** Escalated bodies of all characters, body is restored only when the last character releases it */
+static TMap<TWeakObjectPtr<UPrimitiveComponent>, FTelekinesisBodyEscalation> SharedEscalatedBodies;
+
+/** Escalate body or add one more reference if another character already escalated it 
+    @return - false if body can't be escalated or already used CCD on its own */
+static bool AcquireBodyEscalation(UPrimitiveComponent* Component, uint32 PositionIterations, uint32 VelocityIterations)
+{
+	FTelekinesisBodyEscalation* Escalation = SharedEscalatedBodies.Find(Component);
+	if (Escalation != nullptr)
+	{
+		++Escalation->RefCount;
+		return true;
+	}
+
+	// Body with its own CCD costs the same with or without telekinesis, don't track it
+	FBodyInstance* BodyInstance = Component->GetBodyInstance();
+	if (BodyInstance == nullptr || BodyInstance->bUseCCD)
+	{
+		return false;
+	}
+
+	FTelekinesisBodyEscalation NewEscalation;
+	NewEscalation.RefCount = 1;
+	NewEscalation.PreviousPositionIterations = BodyInstance->PositionSolverIterationCount;
+	NewEscalation.PreviousVelocityIterations = BodyInstance->VelocitySolverIterationCount;
+
+	BodyInstance->SetUseCCD(true);
+
+#if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX
+	// Raise solver iterations on the PhysX actor, never lower them below body's own values
+	FPhysicsCommand::ExecuteWrite(BodyInstance->ActorHandle, [&](const FPhysicsActorHandle& Actor)
+	{
+		if (PxRigidDynamic* RigidDynamic = FPhysicsInterface::GetPxRigidDynamic_AssumesLocked(Actor))
+		{
+			PxU32 PositionCount = 0;
+			PxU32 VelocityCount = 0;
+			RigidDynamic->getSolverIterationCounts(PositionCount, VelocityCount);
+			NewEscalation.PreviousPositionIterations = PositionCount;
+			NewEscalation.PreviousVelocityIterations = VelocityCount;
+			RigidDynamic->setSolverIterationCounts(FMath::Max<PxU32>(PositionCount, PositionIterations),
+			                                       FMath::Max<PxU32>(VelocityCount, VelocityIterations));
+		}
+	});
+#endif
+
+	SharedEscalatedBodies.Add(Component, NewEscalation);
+	INC_DWORD_STAT(STAT_TelekinesisEscalatedBodies);
+	return true;
+}
+
+/** Remove one reference and restore body when no character needs it escalated */
+static void ReleaseBodyEscalation(const TWeakObjectPtr<UPrimitiveComponent>& Component)
+{
+	FTelekinesisBodyEscalation* Escalation = SharedEscalatedBodies.Find(Component);
+	if (Escalation == nullptr || --Escalation->RefCount > 0)
+	{
+		return;
+	}
+
+	// Destroyed component has nothing to restore
+	UPrimitiveComponent* PrimitiveComponent = Component.Get();
+	FBodyInstance* BodyInstance = PrimitiveComponent != nullptr ? PrimitiveComponent->GetBodyInstance() : nullptr;
+	if (BodyInstance != nullptr)
+	{
+		BodyInstance->SetUseCCD(false);
+
+#if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX
+		uint32 PositionCount = Escalation->PreviousPositionIterations;
+		uint32 VelocityCount = Escalation->PreviousVelocityIterations;
+		FPhysicsCommand::ExecuteWrite(BodyInstance->ActorHandle, [&](const FPhysicsActorHandle& Actor)
+		{
+			if (PxRigidDynamic* RigidDynamic = FPhysicsInterface::GetPxRigidDynamic_AssumesLocked(Actor))
+			{
+				RigidDynamic->setSolverIterationCounts(PositionCount, VelocityCount);
+			}
+		});
+#endif
+	}
+
+	SharedEscalatedBodies.Remove(Component);
+	DEC_DWORD_STAT(STAT_TelekinesisEscalatedBodies);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // ATelekenesisCharacter
 
@@ -81,6 +183,13 @@ ATelekinesisCharacter::ATelekinesisCharacter()
 
 	// Set a default value that affects component interpolation
 	StepDistanceValue = 150.f;
+
+	// Set Default CCD escalation values
+	bEscalateCollisionOnTelekinesis = true;
+	EscalationSpeedThreshold = 300.f;
+	EscalationTimeout = 3.f;
+	EscalatedPositionIterations = 16;
+	EscalatedVelocityIterations = 4;
 }
 
 void ATelekinesisCharacter::BeginPlay()
@@ -104,8 +213,18 @@ void ATelekinesisCharacter::BeginPlay()
 	}
 }
 
+void ATelekinesisCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Release every body this character escalated
+	UpdateEscalatedBodies(true);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ATelekinesisCharacter::Tick(float DeltaSeconds)
 {
+	UpdateEscalatedBodies(false);
+
 	if (bObjectGrabbed && PhysicHandle != nullptr)
 	{
 		if (CheckHoldComponents(PhysicHandle->GetGrabbedComponent(), CurrentTelekinesisPower, MinimumFailedDistance))
@@ -189,6 +308,9 @@ void ATelekinesisCharacter::TelekinesisUp()
 
 				bObjectGrabbed = true;
 
+				// Held body is dragged by the handle and can be pushed through walls
+				EscalateBody(PhysicHandle->GetGrabbedComponent());
+
 				// Change Outline Color grabbed mesh
 				if (bCanAffectCustomRender)
 				{
@@ -249,6 +371,9 @@ void ATelekinesisCharacter::ThrowObject()
 		FVector Impulse = FVector(FirstPersonCameraComponent->GetForwardVector() * ImpulseStrength);
 		UPrimitiveComponent* GrabbedComponent = PhysicHandle->GetGrabbedComponent();
 		GrabbedComponent->AddImpulse(Impulse, FName("None"), true);
+
+		// Keep CCD on while the thrown body is fast enough to tunnel
+		EscalateBody(GrabbedComponent);
 		
 		OnOffAttachedSound(TelekinesisUpSoundComponent, false);
 
@@ -357,6 +482,74 @@ bool ATelekinesisCharacter::CheckHoldComponents(UPrimitiveComponent* GrabbedComp
 	return false;
 }
 
+void ATelekinesisCharacter::EscalateBody(UPrimitiveComponent* ComponentToEscalate)
+{
+	if (!bEscalateCollisionOnTelekinesis || ComponentToEscalate == nullptr)
+	{
+		return;
+	}
+
+	float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// Already escalated by this character, only refresh timeout
+	for (FTelekinesisEscalatedBody& EscalatedBody : EscalatedBodies)
+	{
+		if (EscalatedBody.Component.Get() == ComponentToEscalate)
+		{
+			EscalatedBody.LastActiveTime = CurrentTime;
+			return;
+		}
+	}
+
+	if (AcquireBodyEscalation(ComponentToEscalate, EscalatedPositionIterations, EscalatedVelocityIterations))
+	{
+		FTelekinesisEscalatedBody EscalatedBody;
+		EscalatedBody.Component = ComponentToEscalate;
+		EscalatedBody.LastActiveTime = CurrentTime;
+		EscalatedBodies.Add(EscalatedBody);
+	}
+}
+
+void ATelekinesisCharacter::UpdateEscalatedBodies(bool bForceAll)
+{
+	if (EscalatedBodies.Num() == 0)
+	{
+		return;
+	}
+
+	float CurrentTime = GetWorld()->GetTimeSeconds();
+	UPrimitiveComponent* HeldComponent = (bObjectGrabbed && PhysicHandle != nullptr) ? PhysicHandle->GetGrabbedComponent() : nullptr;
+
+	for (int32 Index = EscalatedBodies.Num() - 1; Index >= 0; --Index)
+	{
+		FTelekinesisEscalatedBody& EscalatedBody = EscalatedBodies[Index];
+		UPrimitiveComponent* Component = EscalatedBody.Component.Get();
+
+		if (!bForceAll && Component != nullptr)
+		{
+			// Held body stays escalated, timeout starts after release
+			if (Component == HeldComponent)
+			{
+				EscalatedBody.LastActiveTime = CurrentTime;
+				continue;
+			}
+
+			// Throw impulse is applied on next physics step, so skip speed check in the same frame
+			bool bTimedOut = CurrentTime - EscalatedBody.LastActiveTime > EscalationTimeout;
+			bool bSlowEnough = CurrentTime > EscalatedBody.LastActiveTime
+			                   && Component->GetPhysicsLinearVelocity().Size() < EscalationSpeedThreshold;
+			if (!bTimedOut && !bSlowEnough)
+			{
+				continue;
+			}
+		}
+
+		// Destroyed component is released too, so shared count stays correct
+		ReleaseBodyEscalation(EscalatedBody.Component);
+		EscalatedBodies.RemoveAtSwap(Index);
+	}
+}
+
 void ATelekinesisCharacter::InterpTo(FVector CurrentLocation, FVector DesiredLocation, USceneComponent * ComponentToChange, float StepDistance)
 {
 	float Length = FVector(CurrentLocation - DesiredLocation).Size();
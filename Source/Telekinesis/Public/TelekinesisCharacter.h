@@ -8,6 +8,16 @@
 
 class UInputComponent;
 
+/** Body this character escalated to CCD while it is held or flying after a throw */
+struct FTelekinesisEscalatedBody
+{
+	/** Escalated component, weak so destroyed bodies just drop out of the list */
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	/** World time of the last grab, hold or throw */
+	float LastActiveTime;
+};
+
 UCLASS(config=Game)
 class ATelekinesisCharacter : public ACharacter
 {
@@ -53,6 +63,8 @@ protected:
 
 	virtual void BeginPlay();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Called every frame 
 	virtual void Tick(float DeltaSeconds);
 
@@ -117,6 +129,26 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Telekinesis|Properties")
 	bool bCanAffectCustomRender;
 
+	/** Turn on CCD and raise solver iterations for grabbed and thrown bodies only, instead of project-wide */
+	UPROPERTY(EditAnywhere, Category = "Telekinesis|Physics")
+	bool bEscalateCollisionOnTelekinesis;
+
+	/** Released body speed below which CCD is turned off again */
+	UPROPERTY(EditAnywhere, Category = "Telekinesis|Physics", meta = (ClampMin = 0.f, EditCondition = "bEscalateCollisionOnTelekinesis"))
+	float EscalationSpeedThreshold;
+
+	/** Seconds after release or throw when CCD is turned off regardless of speed */
+	UPROPERTY(EditAnywhere, Category = "Telekinesis|Physics", meta = (ClampMin = 0.f, EditCondition = "bEscalateCollisionOnTelekinesis"))
+	float EscalationTimeout;
+
+	/** Minimum position solver iterations of escalated body */
+	UPROPERTY(EditAnywhere, Category = "Telekinesis|Physics", meta = (ClampMin = 1, ClampMax = 255, EditCondition = "bEscalateCollisionOnTelekinesis"))
+	int32 EscalatedPositionIterations;
+
+	/** Minimum velocity solver iterations of escalated body */
+	UPROPERTY(EditAnywhere, Category = "Telekinesis|Physics", meta = (ClampMin = 1, ClampMax = 255, EditCondition = "bEscalateCollisionOnTelekinesis"))
+	int32 EscalatedVelocityIterations;
+
 	/** Actor be able to spawn particle effects */
 	UPROPERTY(EditAnywhere, Category = "Telekinesis|Effects", meta = (DisplayName = "ActorToReleaseEffect"))
 	TSubclassOf<AActor> ThrowEffect;
@@ -157,6 +189,14 @@ protected:
 		@warning - For correct work , MaxOffset must be more than 500.f */
 	bool CheckHoldComponents(UPrimitiveComponent* GrabbedComponent, USceneComponent* ComparedComponent, float MaxOffset);
 
+	/** Escalate component or refresh its escalation time if already escalated by this character 
+	    @param ComponentToEscalate - Component that was grabbed or thrown */
+	void EscalateBody(UPrimitiveComponent* ComponentToEscalate);
+
+	/** Release escalated bodies that are slow enough or timed out 
+	    @param bForceAll - true = restore every escalated body */
+	void UpdateEscalatedBodies(bool bForceAll);
+
 	/** GetLocation  and interpolate her to desired location */
 	void InterpTo(FVector CurrentLocation, FVector DesiredLocation, USceneComponent* ComponentToChange, float StepDistance);
 
@@ -176,6 +216,9 @@ protected:
 
 	bool bObjectGrabbed;
 
+	/** Bodies currently running with CCD because of telekinesis */
+	TArray<FTelekinesisEscalatedBody> EscalatedBodies;
+
 public:
 
 	/** Returns Mesh1P subobject **/